@@ -0,0 +1,128 @@
+#ifndef TORRENT_BULK_ADD_HPP_INCLUDED
+#define TORRENT_BULK_ADD_HPP_INCLUDED
+
+#include <string>
+#include <vector>
+#include <cstring>
+#include <algorithm>
+
+#include <boost/atomic.hpp>
+#include <boost/bind.hpp>
+#include <boost/shared_ptr.hpp>
+
+#include <libtorrent/error_code.hpp>
+#include <libtorrent/bdecode.hpp>
+#include <libtorrent/add_torrent_params.hpp>
+#include <libtorrent/torrent_info.hpp>
+#include <libtorrent/session_handle.hpp>
+
+#include <worker_pool.hpp>
+
+namespace libtorrent {
+        // Decodes a batch of bencoded torrent files and resume data blobs on a pool of
+        // worker threads, and queues them all with async_add_torrent() afterwards.
+        //
+        // What runs in parallel is the bdecode of every buffer and the torrent_info
+        // construction for torrent files and resume data carrying an info dict.
+        // RC_1_1 has no read_resume_data(), so resume data is still handed over raw
+        // through add_torrent_params::resume_data and decoded once more on the network
+        // thread. For resume data without an info dict only the info-hash is taken here.
+        struct bulk_add
+        {
+        private:
+                struct item
+                {
+                        char const* buffer;
+                        int size;
+                        add_torrent_params params;
+                        error_code ec;
+                };
+
+                std::vector<item> m_items;
+                boost::atomic<int> m_next;
+
+        public:
+                // data holds all buffers back to back, sizes holds the length of each one.
+                // Every item starts as a copy of params without its torrent specific fields
+                // (ti, info_hash, resume_data, url, name), those come from its own buffer only.
+                bulk_add(add_torrent_params const& params, char const* data, int data_size
+                        , int const* sizes, int count) : m_next(0) {
+                        add_torrent_params shared = params;
+                        shared.ti.reset();
+                        shared.info_hash.clear();
+                        shared.resume_data.clear();
+                        shared.url.clear();
+                        shared.name.clear();
+
+                        m_items.resize(count);
+
+                        int offset = 0;
+                        for (int i = 0; i < count; i++) {
+                                m_items[i].params = shared;
+                                m_items[i].buffer = data + offset;
+                                m_items[i].size = std::max(0, std::min(sizes[i], data_size - offset));
+                                offset += m_items[i].size;
+                        };
+                };
+
+                // Returns indexes of the buffers which failed to decode, the rest are added.
+                // num_threads < 1 uses one worker per core.
+                std::vector<int> run(session_handle& ses, int num_threads) {
+                        num_threads = std::min(worker_count(num_threads), int(m_items.size()));
+                        run_workers(num_threads, boost::bind(&bulk_add::decode_worker, this));
+
+                        std::vector<int> failed;
+                        for (int i = 0; i < m_items.size(); i++) {
+                                if (m_items[i].ec) {
+                                        failed.push_back(i);
+                                        continue;
+                                };
+
+                                ses.async_add_torrent(m_items[i].params);
+                        };
+
+                        return failed;
+                };
+
+        private:
+                void decode_worker() {
+                        for (;;) {
+                                int const i = m_next.fetch_add(1);
+                                if (i >= m_items.size()) break;
+
+                                decode(m_items[i]);
+                        };
+                };
+
+                void decode(item& it) {
+                        bdecode_node node;
+                        if (bdecode(it.buffer, it.buffer + it.size, node, it.ec) != 0) return;
+                        if (node.type() != bdecode_node::dict_t) {
+                                it.ec = error_code(errors::torrent_is_no_dict, get_libtorrent_category());
+                                return;
+                        };
+
+                        bool const is_resume = node.dict_find_string_value("file-format") == "libtorrent resume file";
+                        if (is_resume) {
+                                it.params.resume_data.assign(it.buffer, it.buffer + it.size);
+                        };
+
+                        // Torrent files and resume data saved with the info dict carry the metadata,
+                        // resume data without it can only be added by info-hash.
+                        if (!is_resume || node.dict_find_dict("info")) {
+                                it.params.ti.reset(new torrent_info(node, it.ec));
+                                if (it.ec) it.params.ti.reset();
+                                return;
+                        };
+
+                        std::string const info_hash = node.dict_find_string_value("info-hash");
+                        if (info_hash.size() != sha1_hash::size) {
+                                it.ec = error_code(errors::torrent_missing_info, get_libtorrent_category());
+                                return;
+                        };
+                        std::memcpy(it.params.info_hash.data(), info_hash.data(), sha1_hash::size);
+                };
+        };
+}
+
+#endif // TORRENT_BULK_ADD_HPP_INCLUDED
@@ -10,6 +10,13 @@
         ptr = boost::make_shared<libtorrent::entry>(*self->resume_data);
         return *ptr;
     }
+
+    // Bencoded resume data, ready to be passed back to session_handle::async_add_torrents().
+    std::string resume_data_buffer() const {
+        std::string ret;
+        if (self->resume_data) libtorrent::bencode(std::back_inserter(ret), *self->resume_data);
+        return ret;
+    }
 }
 %ignore libtorrent::save_resume_data_alert::resume_data;
 
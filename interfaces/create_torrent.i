@@ -1,5 +1,7 @@
 %{
 #include <libtorrent/create_torrent.hpp>
+#include <piece_hasher.hpp>
 %}
 
 %include <libtorrent/create_torrent.hpp>
+%include <piece_hasher.hpp>
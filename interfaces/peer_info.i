@@ -2,4 +2,92 @@
 #include <libtorrent/peer_info.hpp>
 %}
 
+// Field mask for torrent_handle::get_peer_stats(),
+// columns are written in increasing bit order.
+%inline %{
+namespace libtorrent {
+    enum peer_info_field {
+        peer_field_flags = 1 << 0,
+        peer_field_source = 1 << 1,
+        peer_field_read_state = 1 << 2,
+        peer_field_write_state = 1 << 3,
+        peer_field_up_speed = 1 << 4,
+        peer_field_down_speed = 1 << 5,
+        peer_field_payload_up_speed = 1 << 6,
+        peer_field_payload_down_speed = 1 << 7,
+        peer_field_total_download = 1 << 8,
+        peer_field_total_upload = 1 << 9,
+        peer_field_rtt = 1 << 10,
+        peer_field_num_pieces = 1 << 11,
+        peer_field_progress_ppm = 1 << 12,
+        peer_field_download_queue_length = 1 << 13,
+        peer_field_upload_queue_length = 1 << 14,
+        peer_field_target_dl_queue_length = 1 << 15,
+        peer_field_timed_out_requests = 1 << 16,
+        peer_field_downloading_piece_index = 1 << 17,
+        peer_field_num_hashfails = 1 << 18,
+        peer_field_failcount = 1 << 19,
+        peer_field_connection_type = 1 << 20,
+        peer_field_last_active = 1 << 21,
+        peer_field_all = (1 << 22) - 1
+    };
+
+    // Size of a packed endpoint: IPv6 address (IPv4 is v4-mapped) and big endian port.
+    const int peer_endpoint_size = 18;
+}
+%}
+
+%{
+namespace libtorrent {
+    long long peer_info_value(libtorrent::peer_info const& p, int field) {
+        switch (field) {
+            case peer_field_flags: return p.flags;
+            case peer_field_source: return p.source;
+            case peer_field_read_state: return p.read_state;
+            case peer_field_write_state: return p.write_state;
+            case peer_field_up_speed: return p.up_speed;
+            case peer_field_down_speed: return p.down_speed;
+            case peer_field_payload_up_speed: return p.payload_up_speed;
+            case peer_field_payload_down_speed: return p.payload_down_speed;
+            case peer_field_total_download: return p.total_download;
+            case peer_field_total_upload: return p.total_upload;
+            case peer_field_rtt: return p.rtt;
+            case peer_field_num_pieces: return p.num_pieces;
+            case peer_field_progress_ppm: return p.progress_ppm;
+            case peer_field_download_queue_length: return p.download_queue_length;
+            case peer_field_upload_queue_length: return p.upload_queue_length;
+            case peer_field_target_dl_queue_length: return p.target_dl_queue_length;
+            case peer_field_timed_out_requests: return p.timed_out_requests;
+            case peer_field_downloading_piece_index: return p.downloading_piece_index;
+            case peer_field_num_hashfails: return p.num_hashfails;
+            case peer_field_failcount: return p.failcount;
+            case peer_field_connection_type: return p.connection_type;
+            case peer_field_last_active: return libtorrent::total_milliseconds(p.last_active);
+        }
+        return 0;
+    }
+
+    void pack_peer_endpoint(libtorrent::tcp::endpoint const& ep, char* out) {
+        libtorrent::address const a = ep.address();
+
+        std::memset(out, 0, 16);
+#if TORRENT_USE_IPV6
+        if (a.is_v6()) {
+            libtorrent::address_v6::bytes_type const b = a.to_v6().to_bytes();
+            std::memcpy(out, b.data(), 16);
+        } else
+#endif
+        {
+            libtorrent::address_v4::bytes_type const b = a.to_v4().to_bytes();
+            out[10] = char(0xff);
+            out[11] = char(0xff);
+            std::memcpy(out + 12, b.data(), 4);
+        }
+
+        out[16] = char((ep.port() >> 8) & 0xff);
+        out[17] = char(ep.port() & 0xff);
+    }
+}
+%}
+
 %include <libtorrent/peer_info.hpp>
@@ -16,6 +16,7 @@
 %rename(WrappedAddTorrent) libtorrent::session_handle::add_torrent;
 %rename(WrappedRemoveTorrent) libtorrent::session_handle::remove_torrent;
 %rename(WrappedAsyncAddTorrent) libtorrent::session_handle::async_add_torrent;
+%rename(WrappedAsyncAddTorrents) libtorrent::session_handle::async_add_torrents;
 
 %rename(WrappedTorrentHandle) libtorrent::torrent_handle;
 
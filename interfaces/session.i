@@ -10,6 +10,7 @@
 #include <libtorrent/session_stats.hpp>
 #include <libtorrent/session_status.hpp>
 #include <libtorrent/session_handle.hpp>
+#include <bulk_add.hpp>
 %}
 
 %feature("director") session_handle;
@@ -31,6 +32,17 @@
     self->pop_alerts(&alerts);
     return alerts;
   }
+
+  // Decodes bencoded torrent files / resume data on num_threads workers (one per core when < 1)
+  // and queues all adds. BYTES holds the buffers back to back, ARRAY holds the size of each buffer.
+  // Every torrent gets the settings of params, except ti, info_hash, resume_data, url and name.
+  // Resume data is passed raw and decoded again by libtorrent on the network thread,
+  // see bulk_add.hpp for what is done in parallel. Returns indexes of buffers which failed to decode.
+  std::vector<int> async_add_torrents(libtorrent::add_torrent_params const& params
+    , char* BYTES, int BYTES_LENGTH, int const* ARRAY, int LENGTH, int num_threads) {
+    libtorrent::bulk_add batch(params, BYTES, BYTES_LENGTH, ARRAY, LENGTH);
+    return batch.run(*self, num_threads);
+  }
 }
 %ignore libtorrent::session_handle::pop_alerts;
 
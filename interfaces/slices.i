@@ -0,0 +1,27 @@
+// Typemaps to hand Go slices to C++ as (pointer, length) pairs in a single call,
+// instead of filling std::vector wrappers element by element through cgo.
+// The slice memory is only valid for the duration of the call.
+
+%typemap(gotype) (int const* ARRAY, int LENGTH) "[]int32"
+
+%typemap(in) (int const* ARRAY, int LENGTH)
+%{
+    $1 = (int const*)$input.array;
+    $2 = (int)$input.len;
+%}
+
+%typemap(gotype) (long long* ARRAY, int LENGTH) "[]int64"
+
+%typemap(in) (long long* ARRAY, int LENGTH)
+%{
+    $1 = (long long*)$input.array;
+    $2 = (int)$input.len;
+%}
+
+%typemap(gotype) (char* BYTES, int BYTES_LENGTH) "[]byte"
+
+%typemap(in) (char* BYTES, int BYTES_LENGTH)
+%{
+    $1 = (char*)$input.array;
+    $2 = (int)$input.len;
+%}
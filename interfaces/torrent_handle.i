@@ -5,6 +5,32 @@
 #include <libtorrent/torrent.hpp>
 #include <libtorrent/entry.hpp>
 #include <libtorrent/announce_entry.hpp>
+#include <libtorrent/aux_/session_interface.hpp>
+#include <boost/bind.hpp>
+
+namespace libtorrent {
+    // Runs on the network thread. Applies packed (piece, deadline, priority) triples,
+    // negative deadline resets the piece deadline, negative priority keeps the current one.
+    void apply_piece_deadlines(boost::shared_ptr<libtorrent::torrent> t, std::vector<int> const& entries, bool clear) {
+        if (!t->valid_metadata()) return;
+
+        if (clear) t->clear_time_critical();
+
+        int const num_pieces = t->torrent_file().num_pieces();
+        for (std::size_t i = 0; i + 2 < entries.size(); i += 3) {
+            int const piece = entries[i];
+            int const deadline = entries[i + 1];
+            int const priority = entries[i + 2];
+            if (piece < 0 || piece >= num_pieces) continue;
+
+            // set_piece_deadline() raises the piece to priority 7, so an explicit priority goes last.
+            if (deadline >= 0) t->set_piece_deadline(piece, deadline, 0);
+            else if (!clear) t->reset_piece_deadline(piece);
+
+            if (priority >= 0) t->set_piece_priority(piece, priority);
+        }
+    }
+}
 %}
 
 %include <std_vector.i>
@@ -32,6 +58,54 @@
         return ((libtorrent::memory_storage*) self->get_storage_impl());
     }
 
+    // Sets deadlines and priorities for a window of pieces in one network thread job.
+    // Entries are packed as (piece, deadline_ms, priority) triples,
+    // clear drops all previous deadlines before applying them.
+    // Like other async handle calls, it does nothing on an invalid handle.
+    void set_piece_deadlines(int const* ARRAY, int LENGTH, bool clear) {
+        boost::shared_ptr<libtorrent::torrent> t = self->native_handle();
+        if (!t) return;
+
+        std::vector<int> entries(ARRAY, ARRAY + LENGTH);
+        t->session().get_io_service().post(
+            boost::bind(&libtorrent::apply_piece_deadlines, t, entries, clear));
+    }
+
+    // Exports peer_info of all peers in one call, struct-of-arrays.
+    // Each field selected by mask (see peer_info_field) takes a column of
+    // LENGTH / popcount(mask) values, in increasing bit order.
+    // Endpoints are written as peer_endpoint_size bytes per peer, when BYTES is not empty.
+    // Returns the total number of peers, which may exceed the columns capacity.
+    int get_peer_stats(long long* ARRAY, int LENGTH, unsigned int mask, char* BYTES, int BYTES_LENGTH) {
+        std::vector<libtorrent::peer_info> peers;
+        self->get_peer_info(peers);
+
+        int num_fields = 0;
+        for (int field = 1; field <= libtorrent::peer_field_all; field <<= 1) {
+            if (mask & field) num_fields++;
+        }
+
+        int const capacity = num_fields > 0 ? LENGTH / num_fields : 0;
+        int const count = std::min(int(peers.size()), capacity);
+
+        long long* column = ARRAY;
+        for (int field = 1; field <= libtorrent::peer_field_all; field <<= 1) {
+            if (!(mask & field)) continue;
+
+            for (int i = 0; i < count; i++) {
+                column[i] = libtorrent::peer_info_value(peers[i], field);
+            }
+            column += capacity;
+        }
+
+        int const endpoints = std::min(int(peers.size()), BYTES_LENGTH / libtorrent::peer_endpoint_size);
+        for (int i = 0; i < endpoints; i++) {
+            libtorrent::pack_peer_endpoint(peers[i].ip, BYTES + i * libtorrent::peer_endpoint_size);
+        }
+
+        return int(peers.size());
+    }
+
     // void remove_piece(int piece) const {
     //     // m_picker->remove_piece(piece);
     //     //m_picker->restore_piece(piece);
@@ -268,6 +268,9 @@ namespace libtorrent {
                         return size;
                 };
 
+                // Also serves libtorrent's piece hash check. In RC_1_1 the check is done in
+                // disk_io_thread::do_hash() and a storage_interface has no way to hand it a digest,
+                // so hashing on write here would only add a second SHA-1 pass.
                 int readv(libtorrent::file::iovec_t const* bufs, int num_bufs
                         , int piece, int offset, int flags, libtorrent::storage_error& ec)
                 {
@@ -0,0 +1,157 @@
+#ifndef TORRENT_PIECE_HASHER_HPP_INCLUDED
+#define TORRENT_PIECE_HASHER_HPP_INCLUDED
+
+#include <string>
+#include <vector>
+#include <cstring>
+#include <algorithm>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#endif
+
+#include <boost/atomic.hpp>
+#include <boost/bind.hpp>
+#include <boost/cstdint.hpp>
+#include <boost/thread/mutex.hpp>
+
+#include <libtorrent/error_code.hpp>
+#include <libtorrent/create_torrent.hpp>
+#include <libtorrent/file_storage.hpp>
+#include <libtorrent/file.hpp>
+#include <libtorrent/hasher.hpp>
+
+#include <worker_pool.hpp>
+
+namespace libtorrent {
+        // Hashes create_torrent pieces with a pool of worker threads,
+        // each one reading runs of consecutive pieces with large sequential reads.
+        struct piece_hasher
+        {
+        private:
+                // Bytes read at once by a worker, rounded to whole pieces
+                static const int read_size = 4 * 1024 * 1024;
+
+                boost::atomic<int> m_num_pieces;
+                boost::atomic<int> m_done;
+                boost::atomic<int> m_next;
+                boost::atomic<bool> m_failed;
+
+                boost::mutex m_mutex;
+                error_code m_error;
+
+        public:
+                piece_hasher() : m_num_pieces(0), m_done(0), m_next(0), m_failed(false) {};
+
+                // Number of pieces hashed so far, cheap to poll while hash_pieces() runs.
+                int pieces_done() const {
+                        return m_done.load(boost::memory_order_relaxed);
+                };
+
+                int num_pieces() const {
+                        return m_num_pieces.load(boost::memory_order_relaxed);
+                };
+
+                // Reads the files of t relative to path (the parent directory of the torrent root,
+                // same as libtorrent::set_piece_hashes) and fills the piece hashes in place.
+                // num_threads < 1 uses one worker per core. Failures are reported through ec,
+                // in which case the piece hashes are left untouched.
+                void hash_pieces(create_torrent& t, std::string const& path, int num_threads, error_code& ec) {
+                        num_threads = worker_count(num_threads);
+
+                        m_num_pieces = t.num_pieces();
+                        m_done = 0;
+                        m_next = 0;
+                        m_failed = false;
+                        m_error.clear();
+
+                        int const batch = std::max(1, read_size / t.piece_length());
+                        std::vector<sha1_hash> hashes(t.num_pieces());
+
+                        run_workers(num_threads, boost::bind(&piece_hasher::hash_worker
+                                , this, boost::cref(t), boost::cref(path), boost::ref(hashes), batch));
+
+                        if (m_failed) {
+                                ec = m_error;
+                                return;
+                        };
+                        ec.clear();
+
+                        for (int i = 0; i < hashes.size(); i++) {
+                                t.set_hash(i, hashes[i]);
+                        }
+                };
+
+        private:
+                void hash_worker(create_torrent const& t, std::string const& path
+                        , std::vector<sha1_hash>& hashes, int batch) {
+                        file_storage const& fs = t.files();
+                        std::vector<char> buffer(std::size_t(t.piece_length()) * batch);
+
+                        file f;
+                        int open_file = -1;
+                        error_code ec;
+
+                        while (!m_failed) {
+                                int const first = m_next.fetch_add(batch);
+                                if (first >= m_num_pieces) break;
+                                int const last = std::min(first + batch, int(m_num_pieces));
+
+                                int const size = (last - 1 - first) * t.piece_length() + t.piece_size(last - 1);
+                                std::vector<file_slice> const slices = fs.map_block(first, 0, size);
+
+                                char* p = &buffer[0];
+                                for (int i = 0; i < slices.size(); i++) {
+                                        file_slice const& s = slices[i];
+
+                                        if (fs.pad_file_at(s.file_index)) {
+                                                std::memset(p, 0, s.size);
+                                                p += s.size;
+                                                continue;
+                                        };
+
+                                        if (s.file_index != open_file) {
+                                                f.close();
+                                                if (!f.open(fs.file_path(s.file_index, path), file::read_only, ec)) {
+                                                        fail(ec);
+                                                        return;
+                                                };
+                                                open_file = s.file_index;
+#if defined POSIX_FADV_SEQUENTIAL
+                                                posix_fadvise(f.native_handle(), 0, 0, POSIX_FADV_SEQUENTIAL);
+#endif
+                                        };
+
+                                        file::iovec_t v = { p, std::size_t(s.size) };
+                                        boost::int64_t const n = f.readv(s.offset, &v, 1, ec);
+                                        if (ec) {
+                                                fail(ec);
+                                                return;
+                                        };
+                                        if (n < s.size) {
+                                                fail(error_code(errors::file_too_short, get_libtorrent_category()));
+                                                return;
+                                        };
+
+                                        p += s.size;
+                                };
+
+                                p = &buffer[0];
+                                for (int i = first; i < last; i++) {
+                                        int const len = t.piece_size(i);
+                                        hashes[i] = hasher(p, len).final();
+                                        p += len;
+                                        m_done.fetch_add(1, boost::memory_order_relaxed);
+                                };
+                        };
+                };
+
+                void fail(error_code const& ec) {
+                        boost::unique_lock<boost::mutex> scoped_lock(m_mutex);
+                        if (!m_failed) m_error = ec;
+                        m_failed = true;
+                };
+        };
+}
+
+#endif // TORRENT_PIECE_HASHER_HPP_INCLUDED
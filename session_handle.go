@@ -5,6 +5,7 @@ type SessionHandle interface {
 	WrappedSessionHandle
 	AddTorrent(...interface{}) (TorrentHandle, error)
 	AsyncAddTorrent(AddTorrentParams) error
+	AsyncAddTorrents(AddTorrentParams, []byte, []int32, int) (StdVectorInt, error)
 	RemoveTorrent(...interface{}) error
 }
 
@@ -29,6 +30,14 @@ func (p SessionHandleImpl) AsyncAddTorrent(arg2 AddTorrentParams) (err error) {
 	return
 }
 
+// AsyncAddTorrents is a wrapper for libtorrent::session_handle::async_add_torrents
+func (p SessionHandleImpl) AsyncAddTorrents(arg2 AddTorrentParams, arg3 []byte, arg4 []int32, arg5 int) (ret StdVectorInt, err error) {
+	defer catch(&err)
+
+	ret = p.WrappedAsyncAddTorrents(arg2, arg3, arg4, arg5)
+	return
+}
+
 // RemoveTorrent is a wrapper for libtorrent::session_handle::remove_torrent
 func (p SessionHandleImpl) RemoveTorrent(a ...interface{}) (err error) {
 	defer catch(&err)
@@ -0,0 +1,33 @@
+#ifndef TORRENT_WORKER_POOL_HPP_INCLUDED
+#define TORRENT_WORKER_POOL_HPP_INCLUDED
+
+#include <vector>
+
+#include <boost/shared_ptr.hpp>
+#include <boost/make_shared.hpp>
+#include <boost/thread/thread.hpp>
+
+#include <libtorrent/thread.hpp>
+
+namespace libtorrent {
+        // Number of workers to use, num_threads < 1 means one per core.
+        inline int worker_count(int num_threads) {
+                if (num_threads < 1) num_threads = boost::thread::hardware_concurrency();
+                if (num_threads < 1) num_threads = 1;
+                return num_threads;
+        };
+
+        // Runs f on num_threads threads and waits for all of them to finish.
+        template <class F>
+        void run_workers(int num_threads, F f) {
+                std::vector<boost::shared_ptr<thread> > workers;
+                for (int i = 0; i < num_threads; i++) {
+                        workers.push_back(boost::make_shared<thread>(f));
+                }
+                for (int i = 0; i < workers.size(); i++) {
+                        workers[i]->join();
+                }
+        };
+}
+
+#endif // TORRENT_WORKER_POOL_HPP_INCLUDED